@@ -0,0 +1,339 @@
+/**
+ * @file MorseAbbreviator.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_ABBREVIATOR_HPP
+#define MORSE_ABBREVIATOR_HPP
+
+#include "MorseCodeGenerator.hpp"
+
+#include <array>
+#include <cctype>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class MorseAbbreviator
+ * @brief Rewrites messages with CW abbreviations to minimize airtime.
+ *
+ * Each word or phrase may be sent as written or replaced by a standard
+ * abbreviation (THANKS -> TNX, FINE BUSINESS -> FB). A number in exchange
+ * position, right after RST, NR, 5NN, or 599, may also be sent with cut
+ * digits (RST 599 -> RST 5NN, NR 100 -> NR 1TT). Other numbers, such as
+ * frequencies, and numbers that are themselves abbreviations (73) are
+ * always sent as written, and a cut always keeps at least one digit. A dynamic
+ * program over the words picks the cheapest combination, costed with
+ * MorseCodeGenerator::wordUnits(), so a rewrite is only used when it
+ * actually saves time. A rewrite that would spell a prosign (70 -> BT) is
+ * never used, since it would be sent as the prosign.
+ */
+class MorseAbbreviator
+{
+public:
+    /**
+     * @brief Outcome of an optimize() call.
+     */
+    struct Result
+    {
+        std::string text;
+        size_t originalUnits;
+        size_t units;
+    };
+
+    /**
+     * @brief Loads the standard abbreviation set.
+     *
+     * @param fullCuts False to cut only 0 -> T and 9 -> N, the cuts every
+     *        operator expects; true to also use A, U, V, E, B, and D for
+     *        1, 2, 3, 5, 7, and 8.
+     */
+    explicit MorseAbbreviator(bool fullCuts = false)
+    {
+        cuts.fill('\0');
+        cuts['0'] = 'T';
+        cuts['9'] = 'N';
+        if (fullCuts)
+        {
+            cuts['1'] = 'A';
+            cuts['2'] = 'U';
+            cuts['3'] = 'V';
+            cuts['5'] = 'E';
+            cuts['7'] = 'B';
+            cuts['8'] = 'D';
+        }
+
+        static const char *const standard[][2] = {
+            {"THANKS", "TNX"}, {"THANK YOU", "TU"}, {"FINE BUSINESS", "FB"},
+            {"PLEASE", "PSE"}, {"REPORT", "RPT"}, {"YOUR", "UR"},
+            {"YOU", "U"}, {"ARE", "R"}, {"AND", "ES"}, {"HERE", "HR"},
+            {"GOOD", "GD"}, {"GOOD MORNING", "GM"}, {"GOOD AFTERNOON", "GA"},
+            {"GOOD EVENING", "GE"}, {"BEST REGARDS", "73"}, {"AGAIN", "AGN"},
+            {"WEATHER", "WX"}, {"ANTENNA", "ANT"}, {"POWER", "PWR"},
+            {"CONDITIONS", "CONDX"}, {"RECEIVER", "RX"}, {"TRANSMITTER", "TX"},
+            {"OLD MAN", "OM"}, {"NAME", "NM"}, {"NUMBER", "NR"},
+            {"BEFORE", "B4"}, {"FOR", "FER"},
+        };
+        for (const auto &entry : standard)
+        {
+            addAbbreviation(entry[0], entry[1]);
+        }
+        for (const char *word : {"RST", "NR", "5NN", "599"})
+        {
+            addExchangeWord(word);
+        }
+    }
+
+    /**
+     * @brief Marks a word as introducing an exchange number.
+     *
+     * A number right after this word may be sent with cut digits.
+     *
+     * @param word Single word, matched case-insensitively.
+     */
+    void addExchangeWord(std::string_view word)
+    {
+        exchangeWords.insert(upper(word));
+    }
+
+    /**
+     * @brief Adds or replaces an abbreviation.
+     *
+     * @param phrase       One or more words, matched case-insensitively.
+     * @param abbreviation Single word to send instead.
+     */
+    void addAbbreviation(std::string_view phrase, std::string_view abbreviation)
+    {
+        std::vector<std::string> words = split(phrase);
+        if (words.empty())
+        {
+            return;
+        }
+        auto &candidates = phrases[words[0]];
+        for (auto &candidate : candidates)
+        {
+            if (candidate.words == words)
+            {
+                candidate.abbreviation = upper(abbreviation);
+                return;
+            }
+        }
+        candidates.push_back({std::move(words), upper(abbreviation)});
+    }
+
+    /**
+     * @brief Rewrites a message for minimum airtime.
+     *
+     * @param text Plain message text.
+     * @throws std::invalid_argument If an unsupported character is encountered.
+     * @return Rewritten text with its airtime before and after, in dit units.
+     */
+    Result optimize(std::string_view text) const
+    {
+        const std::vector<std::string> words = split(text);
+        const size_t n = words.size();
+
+        // best[i] is the cheapest airtime for words[i..n), choice[i] the pick.
+        std::vector<size_t> best(n + 1, 0);
+        std::vector<Choice> choice(n);
+        std::vector<size_t> plain(n);
+        std::vector<std::string> cut(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            plain[i] = generator.wordUnits(words[i]);
+            if (i > 0 && exchangeWords.count(words[i - 1]))
+            {
+                cut[i] = cutNumber(words[i]);
+            }
+        }
+
+        for (size_t i = n; i-- > 0;)
+        {
+            const size_t gap = (i + 1 < n) ? 7 : 0;
+            best[i] = plain[i] + gap + best[i + 1];
+            choice[i] = {1, nullptr};
+
+            if (!cut[i].empty() && !generator.isProsign(cut[i]))
+            {
+                const size_t cost = generator.wordUnits(cut[i]) + gap + best[i + 1];
+                if (cost < best[i])
+                {
+                    best[i] = cost;
+                    choice[i] = {1, &cut[i]};
+                }
+            }
+
+            auto it = phrases.find(words[i]);
+            if (it == phrases.end())
+            {
+                continue;
+            }
+            for (const auto &candidate : it->second)
+            {
+                const size_t span = candidate.words.size();
+                if (i + span > n || !matches(words, i, candidate.words) ||
+                    generator.isProsign(candidate.abbreviation))
+                {
+                    continue;
+                }
+                const size_t cost = generator.wordUnits(candidate.abbreviation) +
+                                    ((i + span < n) ? 7 : 0) + best[i + span];
+                if (cost < best[i])
+                {
+                    best[i] = cost;
+                    choice[i] = {span, &candidate.abbreviation};
+                }
+            }
+        }
+
+        Result result{std::string(), 0, best[0]};
+        for (size_t i = 0; i < n; ++i)
+        {
+            result.originalUnits += plain[i] + ((i + 1 < n) ? 7 : 0);
+        }
+        for (size_t i = 0; i < n; i += choice[i].span)
+        {
+            if (!result.text.empty())
+            {
+                result.text += ' ';
+            }
+            result.text += choice[i].replacement ? *choice[i].replacement : words[i];
+        }
+        return result;
+    }
+
+private:
+    struct Phrase
+    {
+        std::vector<std::string> words;
+        std::string abbreviation;
+    };
+
+    struct Choice
+    {
+        size_t span;
+        const std::string *replacement;
+    };
+
+    MorseCodeGenerator generator;
+    std::unordered_map<std::string, std::vector<Phrase>> phrases;
+    std::array<char, 128> cuts;
+    std::unordered_set<std::string> exchangeWords;
+
+    static std::string upper(std::string_view text)
+    {
+        std::string result(text);
+        for (char &c : result)
+        {
+            c = std::toupper(c);
+        }
+        return result;
+    }
+
+    static std::vector<std::string> split(std::string_view text)
+    {
+        std::vector<std::string> tokens;
+        std::istringstream stream{std::string(text)};
+        std::string word;
+        while (stream >> word)
+        {
+            tokens.push_back(upper(word));
+        }
+        return tokens;
+    }
+
+    static bool matches(const std::vector<std::string> &words, size_t at, const std::vector<std::string> &phrase)
+    {
+        for (size_t k = 0; k < phrase.size(); ++k)
+        {
+            if (words[at + k] != phrase[k])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns true if a word is the abbreviation of some phrase.
+     */
+    bool isAbbreviation(const std::string &word) const
+    {
+        for (const auto &entry : phrases)
+        {
+            for (const auto &candidate : entry.second)
+            {
+                if (candidate.abbreviation == word)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the cut form of an all-digit word, or "" if none.
+     *
+     * If every digit has a cut, the first is left as a digit so the word
+     * still reads as a number (999 -> 9NN).
+     */
+    std::string cutNumber(const std::string &word) const
+    {
+        if (isAbbreviation(word))
+        {
+            return std::string();
+        }
+        std::string result(word);
+        bool digitLeft = false;
+        for (char &c : result)
+        {
+            if (!std::isdigit(static_cast<unsigned char>(c)))
+            {
+                return std::string();
+            }
+            if (cuts[static_cast<unsigned char>(c)])
+            {
+                c = cuts[static_cast<unsigned char>(c)];
+            }
+            else
+            {
+                digitLeft = true;
+            }
+        }
+        if (!digitLeft && !result.empty())
+        {
+            result[0] = word[0];
+        }
+        return (result != word) ? result : std::string();
+    }
+};
+
+#endif // MORSE_ABBREVIATOR_HPP
@@ -0,0 +1,233 @@
+/**
+ * @file MorseBeacon.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_BEACON_HPP
+#define MORSE_BEACON_HPP
+
+#include "MorseSequencer.hpp"
+
+// Absolute clock_nanosleep() and per-thread timer slack are Linux
+// facilities, so the beacon is only built there.
+#ifdef __linux__
+#define MORSE_BEACON_SUPPORTED 1
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <sys/prctl.h>
+#include <time.h>
+#include <vector>
+
+/**
+ * @class MorseBeacon
+ * @brief Sends one message at a fixed interval with as few wakeups as possible.
+ *
+ * The key and T/R schedule is computed once up front. Between
+ * transmissions the thread sleeps in one long absolute wait with a wide
+ * timer slack, which lets the kernel batch the wakeup with other timers,
+ * and stops `idleSlack` early. It then narrows the slack, sleeps precisely
+ * to the start of the window, and wakes only for the scheduled edges.
+ *
+ * Timer slack is set per thread through prctl() and restored when run()
+ * returns or throws. Linux only: MORSE_BEACON_SUPPORTED is defined when the
+ * class is available.
+ */
+class MorseBeacon
+{
+public:
+    /**
+     * @brief Power figures for one run().
+     */
+    struct Stats
+    {
+        uint64_t transmissions = 0;
+        uint64_t wakeups = 0;
+        std::chrono::nanoseconds cpuTime{0};
+        std::chrono::nanoseconds elapsed{0};
+
+        /**
+         * @brief Returns sleep returns per hour of wall-clock time.
+         */
+        double wakeupsPerHour() const
+        {
+            const double hours = std::chrono::duration<double, std::ratio<3600>>(elapsed).count();
+            return hours > 0.0 ? static_cast<double>(wakeups) / hours : 0.0;
+        }
+
+        /**
+         * @brief Returns thread CPU time per transmission, idle time included.
+         */
+        std::chrono::nanoseconds cpuPerTransmission() const
+        {
+            return transmissions ? cpuTime / static_cast<int64_t>(transmissions) : std::chrono::nanoseconds(0);
+        }
+    };
+
+    /**
+     * @brief Precomputes the schedule for one transmission.
+     *
+     * @param timeline  Encoded message.
+     * @param wpm       Speed in words per minute (PARIS).
+     * @param sequencer T/R lead and tail.
+     * @param interval  Start-to-start time between transmissions.
+     * @param idleSlack Timer slack while idle; the long wait ends this much
+     *                  before the window so a late wakeup is never late.
+     * @throws std::invalid_argument If a transmission does not fit in the
+     *         interval.
+     */
+    MorseBeacon(const MorseTimeline &timeline, double wpm, const MorseSequencer &sequencer,
+                std::chrono::nanoseconds interval,
+                std::chrono::nanoseconds idleSlack = std::chrono::milliseconds(50))
+        : events(sequencer.schedule(timeline, wpm)), period(interval), slack(idleSlack)
+    {
+        if (events.empty() || events.back().at + slack >= period)
+        {
+            throw std::invalid_argument("Beacon interval too short for the message");
+        }
+    }
+
+    /**
+     * @brief Sends the message a number of times, one interval apart.
+     *
+     * The first transmission starts one interval after the call.
+     *
+     * @param transmissions How many times to send.
+     * @param output        Called as output(MorseSequencer::Line, bool on)
+     *                      at each scheduled edge.
+     * @return Wakeup and CPU figures for the run.
+     */
+    template <typename Output>
+    Stats run(uint64_t transmissions, Output &&output)
+    {
+        Stats stats;
+        SlackGuard guard;
+        const auto cpuStart = threadCpuTime();
+        const auto wallStart = monotonicNow();
+
+        std::chrono::nanoseconds start = wallStart;
+        for (uint64_t n = 0; n < transmissions; ++n)
+        {
+            start += period;
+
+            setSlack(slack.count());
+            stats.wakeups += sleepUntil(start - slack);
+
+            setSlack(windowSlack);
+            stats.wakeups += sleepUntil(start);
+            std::chrono::microseconds reached{0};
+            for (const auto &event : events)
+            {
+                // Edges sharing a time go out on the same wakeup.
+                if (event.at > reached)
+                {
+                    stats.wakeups += sleepUntil(start + event.at);
+                    reached = event.at;
+                }
+                output(event.line, event.on);
+            }
+            ++stats.transmissions;
+        }
+
+        stats.cpuTime = threadCpuTime() - cpuStart;
+        stats.elapsed = monotonicNow() - wallStart;
+        return stats;
+    }
+
+private:
+    // Slack inside the window, in ns: tight enough to keep edges on time.
+    static constexpr int64_t windowSlack = 1000;
+
+    std::vector<MorseSequencer::Event> events;
+    std::chrono::nanoseconds period;
+    std::chrono::nanoseconds slack;
+
+    static std::chrono::nanoseconds fromTimespec(const timespec &ts)
+    {
+        return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+    }
+
+    static std::chrono::nanoseconds monotonicNow()
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return fromTimespec(ts);
+    }
+
+    static std::chrono::nanoseconds threadCpuTime()
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return fromTimespec(ts);
+    }
+
+    /**
+     * @brief Sleeps to an absolute CLOCK_MONOTONIC time.
+     *
+     * @return Number of times the thread woke, counting signal interruptions.
+     */
+    static uint64_t sleepUntil(std::chrono::nanoseconds when)
+    {
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(std::chrono::duration_cast<std::chrono::seconds>(when).count());
+        ts.tv_nsec = static_cast<long>((when - std::chrono::seconds(ts.tv_sec)).count());
+
+        uint64_t wakeups = 1;
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        {
+            ++wakeups;
+        }
+        return wakeups;
+    }
+
+    static void setSlack(int64_t nanoseconds)
+    {
+        prctl(PR_SET_TIMERSLACK, static_cast<unsigned long>(nanoseconds > 0 ? nanoseconds : 1), 0, 0, 0);
+    }
+
+    /**
+     * @brief Restores the thread's timer slack on scope exit.
+     */
+    class SlackGuard
+    {
+    public:
+        SlackGuard() : saved(prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0)) {}
+        ~SlackGuard()
+        {
+            setSlack(saved);
+        }
+        SlackGuard(const SlackGuard &) = delete;
+        SlackGuard &operator=(const SlackGuard &) = delete;
+
+    private:
+        int64_t saved;
+    };
+};
+
+#endif // __linux__
+#endif // MORSE_BEACON_HPP
@@ -29,6 +29,8 @@
 #ifndef MORSE_CODE_GENERATOR_HPP
 #define MORSE_CODE_GENERATOR_HPP
 
+#include <array>
+#include <cstdint>
 #include <unordered_map>
 #include <string>
 #include <string_view>
@@ -37,6 +39,36 @@
 #include <sstream>
 #include <vector>
 
+#include "MorseString.hpp"
+
+/**
+ * @brief Static tracepoints (USDT) for perf and bpftrace.
+ *
+ * When <sys/sdt.h> is available (systemtap-sdt-dev), each probe compiles to
+ * a single nop plus a note in the ELF; it costs nothing until a tracer
+ * attaches. Define MORSE_NO_PROBES to compile them out entirely. All probes
+ * live in the "morse" provider:
+ *
+ * - message_set(const char *msg, size_t length, size_t words)
+ * - word_encoded(size_t index, const char *morse, size_t length)
+ * - message_encoded(const char *morse, size_t length, size_t words)
+ *
+ * See tools/morse_trace.sh for an example.
+ */
+#if !defined(MORSE_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define MORSE_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(morse, name, a1, a2, a3)
+#endif
+#endif
+
+#ifndef MORSE_PROBE3
+#define MORSE_PROBE3(name, a1, a2, a3) \
+    do                                 \
+    {                                  \
+    } while (0)
+#endif
+
 /**
  * @class MorseCodeGenerator
  * @brief Translates alphanumeric text and prosigns into Morse code.
@@ -65,6 +97,7 @@ public:
         message = msg;
         words = tokenizeMessage(message);
         wordIndex = 0;
+        MORSE_PROBE3(message_set, message.c_str(), message.size(), words.size());
     }
 
     /**
@@ -96,45 +129,23 @@ public:
      * @throws std::invalid_argument If an unsupported character is encountered.
      * @return Morse-encoded string with proper spacing.
      */
-    std::string getMessage() const
+    MorseString getMessage() const
     {
-        std::string result;
+        MorseString result;
         bool firstWord = true;
 
-        for (const auto &word : tokenizeMessage(message))
+        for (const auto &word : words)
         {
             if (!firstWord)
             {
                 result += "       "; // 7 spaces between words
             }
 
-            if (prosigns.count(word))
-            {
-                result += prosigns.at(word);
-            }
-            else
-            {
-                bool firstChar = true;
-                for (char c : word)
-                {
-                    c = std::toupper(c);
-                    auto it = morseTable.find(c);
-                    if (it == morseTable.end())
-                    {
-                        throw std::invalid_argument("Unsupported character: " + std::string(1, c));
-                    }
-                    if (!firstChar)
-                    {
-                        result += "   "; // 3 spaces between letters
-                    }
-                    result += it->second;
-                    firstChar = false;
-                }
-            }
-
+            encodeWord(word, result);
             firstWord = false;
         }
 
+        MORSE_PROBE3(message_encoded, result.c_str(), result.size(), words.size());
         return result;
     }
 
@@ -147,20 +158,47 @@ public:
      * @throws std::invalid_argument If an unsupported character is encountered.
      * @return Morse-encoded word or prosign, or "<EOM>" at the end.
      */
-    std::string getNext()
+    MorseString getNext()
     {
         if (wordIndex >= words.size())
         {
-            return "<EOM>";
+            return MorseString("<EOM>");
         }
 
-        const auto &word = words[wordIndex++];
-        if (prosigns.count(word))
+        const size_t index = wordIndex++;
+        MorseString result;
+        encodeWord(words[index], result);
+
+        MORSE_PROBE3(word_encoded, index, result.c_str(), result.size());
+        return result;
+    }
+
+    /**
+     * @brief Appends the Morse code for a single word to a string.
+     *
+     * The word is matched case-insensitively. A word that is exactly a
+     * prosign is translated as the prosign; otherwise each character is
+     * translated and separated by 3 spaces. Nothing is written on error.
+     * Does not allocate beyond growing the output.
+     *
+     * @tparam Out std::string or MorseString.
+     * @param word A single word with no whitespace.
+     * @param out  String the Morse code is appended to.
+     * @throws std::invalid_argument If an unsupported character is encountered.
+     */
+    template <typename Out>
+    void encodeWord(std::string_view word, Out &out) const
+    {
+        for (const auto &prosign : prosigns)
         {
-            return prosigns.at(word);
+            if (equalsUpper(word, prosign.first))
+            {
+                out += prosign.second;
+                return;
+            }
         }
 
-        std::string result;
+        const size_t start = out.size();
         bool first = true;
         for (char c : word)
         {
@@ -168,17 +206,88 @@ public:
             auto it = morseTable.find(c);
             if (it == morseTable.end())
             {
+                out.resize(start);
                 throw std::invalid_argument("Unsupported character: " + std::string(1, c));
             }
             if (!first)
             {
-                result += "   ";
+                out += "   "; // 3 spaces between letters
             }
-            result += it->second;
+            out += it->second;
             first = false;
         }
+    }
 
-        return result;
+    /**
+     * @brief Returns true if a word is sent as a prosign.
+     *
+     * @param word A single word, matched case-insensitively.
+     */
+    bool isProsign(std::string_view word) const
+    {
+        for (const auto &prosign : prosigns)
+        {
+            if (equalsUpper(word, prosign.first))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the duration of a Morse string in dit units.
+     *
+     * A dit is 1 unit and a dah is 3. Every space in the getMessage()
+     * format is one unit of silence, so element, letter, and word gaps
+     * count as 1, 3, and 7 units.
+     *
+     * @param morse Morse string in the getMessage() format.
+     * @return Length of the string in dit units.
+     */
+    static size_t countUnits(std::string_view morse)
+    {
+        size_t units = 0;
+        for (char c : morse)
+        {
+            units += (c == '-') ? 3 : 1;
+        }
+        return units;
+    }
+
+    /**
+     * @brief Returns the airtime of one word in dit units without encoding it.
+     *
+     * Uses per-character unit counts precomputed from the Morse table, so
+     * the result equals countUnits() of the encoded word at a fraction of
+     * the cost.
+     *
+     * @param word A single word with no whitespace.
+     * @throws std::invalid_argument If an unsupported character is encountered.
+     * @return Length of the word in dit units, including letter gaps.
+     */
+    size_t wordUnits(std::string_view word) const
+    {
+        for (const auto &prosign : prosigns)
+        {
+            if (equalsUpper(word, prosign.first))
+            {
+                return countUnits(prosign.second);
+            }
+        }
+
+        size_t units = 0;
+        for (char c : word)
+        {
+            const unsigned char upper = static_cast<unsigned char>(std::toupper(c));
+            const uint8_t count = upper < unitTable.size() ? unitTable[upper] : 0;
+            if (count == 0)
+            {
+                throw std::invalid_argument("Unsupported character: " + std::string(1, static_cast<char>(upper)));
+            }
+            units += count;
+        }
+        return word.empty() ? 0 : units + 3 * (word.size() - 1);
     }
 
 private:
@@ -186,6 +295,22 @@ private:
     std::vector<std::string> words;
     size_t wordIndex = 0;
 
+    static bool equalsUpper(std::string_view word, std::string_view upper)
+    {
+        if (word.size() != upper.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < word.size(); ++i)
+        {
+            if (std::toupper(static_cast<unsigned char>(word[i])) != upper[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     std::vector<std::string> tokenizeMessage(const std::string &msg) const
     {
         std::vector<std::string> tokens;
@@ -224,6 +349,19 @@ private:
         {"SK", ". . . - . -"},
         {"BT", "- . . . -"},
     };
+
+    // Declared after morseTable so it is built from it.
+    const std::array<uint8_t, 128> unitTable = buildUnitTable(morseTable);
+
+    static std::array<uint8_t, 128> buildUnitTable(const std::unordered_map<char, std::string> &table)
+    {
+        std::array<uint8_t, 128> units{};
+        for (const auto &entry : table)
+        {
+            units[static_cast<unsigned char>(entry.first)] = static_cast<uint8_t>(countUnits(entry.second));
+        }
+        return units;
+    }
 };
 
 #endif // MORSE_CODE_GENERATOR_HPP
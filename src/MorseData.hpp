@@ -0,0 +1,338 @@
+/**
+ * @file MorseData.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_DATA_HPP
+#define MORSE_DATA_HPP
+
+#include "MorseCodeGenerator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class MorseData
+ * @brief Sends small binary payloads as Morse code.
+ *
+ * Payloads are framed as:
+ *
+ *     version (1 byte) | length (1 byte) | payload | CRC-16/CCITT (2 bytes)
+ *
+ * The frame is split into 5-bit symbols, most significant bit first, and
+ * each symbol is sent as one of the 32 letters and digits with the
+ * shortest Morse code. Base-36 would pack slightly denser, but it would
+ * have to use the four costliest characters too; base-32 keeps only the
+ * cheapest ones, which lowers airtime and needs no bignum arithmetic. The
+ * frame is a single word, so it never collides with a prosign.
+ *
+ * With FEC enabled, every 4 symbols are followed by an XOR parity symbol.
+ * Any one unreadable character per group is then recovered on decode.
+ */
+class MorseData
+{
+public:
+    /**
+     * @brief Largest payload that fits in one frame.
+     */
+    static constexpr size_t maxPayload = 255;
+
+    /**
+     * @brief Builds the symbol alphabet.
+     *
+     * @param fec True to add one parity symbol after every 4 symbols.
+     */
+    explicit MorseData(bool fec = false) : useFec(fec)
+    {
+        std::vector<std::pair<size_t, char>> candidates;
+        for (char c : std::string_view("ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"))
+        {
+            std::string morse;
+            generator.encodeWord(std::string_view(&c, 1), morse);
+            candidates.emplace_back(MorseCodeGenerator::countUnits(morse), c);
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        decodeTable.fill(erasure);
+        for (size_t i = 0; i < symbolMorse.size(); ++i)
+        {
+            symbolChars += candidates[i].second;
+            generator.encodeWord(std::string_view(&candidates[i].second, 1), symbolMorse[i]);
+            decodeTable[elementCode(symbolMorse[i])] = static_cast<uint8_t>(i);
+        }
+    }
+
+    /**
+     * @brief Returns the 32 characters used for symbols 0 through 31.
+     */
+    const std::string &alphabet() const
+    {
+        return symbolChars;
+    }
+
+    /**
+     * @brief Encodes a payload as a framed Morse word.
+     *
+     * @param payload Bytes to send, at most maxPayload.
+     * @throws std::invalid_argument If the payload is too long.
+     * @return Morse string in the getMessage() format.
+     */
+    std::string encode(const std::vector<uint8_t> &payload) const
+    {
+        if (payload.size() > maxPayload)
+        {
+            throw std::invalid_argument("Payload too long: " + std::to_string(payload.size()));
+        }
+
+        std::vector<uint8_t> frame;
+        frame.reserve(payload.size() + 4);
+        frame.push_back(version);
+        frame.push_back(static_cast<uint8_t>(payload.size()));
+        frame.insert(frame.end(), payload.begin(), payload.end());
+        const uint16_t crc = crc16(frame.data(), frame.size());
+        frame.push_back(static_cast<uint8_t>(crc >> 8));
+        frame.push_back(static_cast<uint8_t>(crc & 0xFF));
+
+        std::vector<uint8_t> symbols;
+        symbols.reserve(frame.size() * 2 + 2);
+        uint32_t acc = 0;
+        int bits = 0;
+        uint8_t parity = 0;
+        size_t inGroup = 0;
+        auto push = [&](uint8_t symbol)
+        {
+            symbols.push_back(symbol);
+            if (!useFec)
+            {
+                return;
+            }
+            parity ^= symbol;
+            if (++inGroup == 4)
+            {
+                symbols.push_back(parity);
+                parity = 0;
+                inGroup = 0;
+            }
+        };
+
+        for (uint8_t byte : frame)
+        {
+            acc = (acc << 8) | byte;
+            bits += 8;
+            while (bits >= 5)
+            {
+                bits -= 5;
+                push(static_cast<uint8_t>((acc >> bits) & 0x1F));
+            }
+        }
+        if (bits > 0)
+        {
+            push(static_cast<uint8_t>((acc << (5 - bits)) & 0x1F));
+        }
+        if (useFec && inGroup > 0)
+        {
+            symbols.push_back(parity);
+        }
+
+        std::string result;
+        result.reserve(symbols.size() * 12);
+        for (size_t i = 0; i < symbols.size(); ++i)
+        {
+            if (i > 0)
+            {
+                result += "   "; // 3 spaces between letters
+            }
+            result += symbolMorse[symbols[i]];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Decodes a framed Morse word back into its payload.
+     *
+     * @param morse Morse string in the getMessage() format.
+     * @throws std::invalid_argument If a character cannot be read or
+     *         recovered, the frame is truncated, or the CRC does not match.
+     * @return The payload bytes.
+     */
+    std::vector<uint8_t> decode(std::string_view morse) const
+    {
+        std::vector<uint8_t> symbols;
+        symbols.reserve(morse.size() / 8 + 1);
+        size_t pos = 0;
+        while (pos < morse.size())
+        {
+            while (pos < morse.size() && morse[pos] == ' ')
+            {
+                ++pos;
+            }
+            size_t end = morse.find("   ", pos);
+            if (end == std::string_view::npos)
+            {
+                end = morse.size();
+            }
+            if (end > pos)
+            {
+                size_t code = elementCode(morse.substr(pos, end - pos));
+                symbols.push_back(code < decodeTable.size() ? decodeTable[code] : erasure);
+            }
+            pos = end;
+        }
+
+        if (useFec)
+        {
+            symbols = correct(symbols);
+        }
+
+        std::vector<uint8_t> frame;
+        frame.reserve(symbols.size() * 5 / 8);
+        uint32_t acc = 0;
+        int bits = 0;
+        for (uint8_t symbol : symbols)
+        {
+            if (symbol == erasure)
+            {
+                throw std::invalid_argument("Unreadable character in data frame");
+            }
+            acc = (acc << 5) | symbol;
+            bits += 5;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                frame.push_back(static_cast<uint8_t>((acc >> bits) & 0xFF));
+            }
+        }
+
+        if (frame.size() < 4 || frame[0] != version || frame.size() < frame[1] + 4u)
+        {
+            throw std::invalid_argument("Truncated or unknown data frame");
+        }
+        const size_t length = frame[1];
+        const uint16_t crc = static_cast<uint16_t>((frame[length + 2] << 8) | frame[length + 3]);
+        if (crc != crc16(frame.data(), length + 2))
+        {
+            throw std::invalid_argument("Data frame CRC mismatch");
+        }
+        return std::vector<uint8_t>(frame.begin() + 2, frame.begin() + 2 + length);
+    }
+
+private:
+    static constexpr uint8_t version = 1;
+    static constexpr uint8_t erasure = 0xFF;
+
+    MorseCodeGenerator generator;
+    bool useFec;
+    std::string symbolChars;
+    std::array<std::string, 32> symbolMorse;
+    std::array<uint8_t, 128> decodeTable{};
+
+    /**
+     * @brief Maps a letter's elements to a unique small integer.
+     *
+     * A leading 1 bit marks the length; each dit adds a 0 and each dah a 1.
+     * Letters longer than 6 elements map past the decode table.
+     */
+    static size_t elementCode(std::string_view letter)
+    {
+        size_t code = 1;
+        for (char c : letter)
+        {
+            if (c == '.' || c == '-')
+            {
+                code = (code << 1) | (c == '-');
+                if (code >= 128)
+                {
+                    return code;
+                }
+            }
+        }
+        return code;
+    }
+
+    /**
+     * @brief Strips parity symbols, recovering one erasure per group.
+     */
+    static std::vector<uint8_t> correct(const std::vector<uint8_t> &symbols)
+    {
+        std::vector<uint8_t> data;
+        data.reserve(symbols.size());
+        for (size_t start = 0; start < symbols.size(); start += 5)
+        {
+            const size_t end = std::min(start + 5, symbols.size());
+            if (end - start < 2)
+            {
+                throw std::invalid_argument("Truncated data frame");
+            }
+            uint8_t parity = 0;
+            size_t missing = end;
+            for (size_t i = start; i < end; ++i)
+            {
+                if (symbols[i] != erasure)
+                {
+                    parity ^= symbols[i];
+                }
+                else if (missing == end)
+                {
+                    missing = i;
+                }
+                else
+                {
+                    throw std::invalid_argument("Unrecoverable data frame group");
+                }
+            }
+            for (size_t i = start; i + 1 < end; ++i)
+            {
+                data.push_back(i == missing ? parity : symbols[i]);
+            }
+        }
+        return data;
+    }
+
+    /**
+     * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF).
+     */
+    static uint16_t crc16(const uint8_t *data, size_t length)
+    {
+        uint16_t crc = 0xFFFF;
+        for (size_t i = 0; i < length; ++i)
+        {
+            crc ^= static_cast<uint16_t>(data[i] << 8);
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                                     : static_cast<uint16_t>(crc << 1);
+            }
+        }
+        return crc;
+    }
+};
+
+#endif // MORSE_DATA_HPP
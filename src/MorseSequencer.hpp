@@ -0,0 +1,145 @@
+/**
+ * @file MorseSequencer.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_SEQUENCER_HPP
+#define MORSE_SEQUENCER_HPP
+
+#include "MorseTimeline.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @class MorseSequencer
+ * @brief Schedules key and T/R (PTT) outputs from one timeline.
+ *
+ * T/R is asserted `lead` before a key-down and released `tail` after a
+ * key-up. When the next key-down would need T/R again before the tail has
+ * run out, T/R is simply held, so it never drops inside a window and
+ * never switches while the key is down.
+ *
+ * T/R drops in any key-up gap longer than lead + tail. A short lead and
+ * tail (a few ms) gives full break-in (QSK), releasing even between the
+ * elements of a letter at normal speeds. A tail of a few hundred ms gives
+ * semi break-in, holding through words and releasing only at pauses.
+ */
+class MorseSequencer
+{
+public:
+    /**
+     * @brief Output line an event drives.
+     */
+    enum class Line
+    {
+        Key,
+        TR
+    };
+
+    /**
+     * @brief A change on one output at a time offset from the start.
+     */
+    struct Event
+    {
+        std::chrono::microseconds at;
+        Line line;
+        bool on;
+    };
+
+    /**
+     * @brief Sets the sequencing constraints.
+     *
+     * @param lead Time T/R must be asserted before any key-down.
+     * @param tail Time T/R must stay asserted after any key-up.
+     * @throws std::invalid_argument If either time is negative.
+     */
+    MorseSequencer(std::chrono::microseconds lead, std::chrono::microseconds tail)
+        : leadTime(lead), tailTime(tail)
+    {
+        if (lead.count() < 0 || tail.count() < 0)
+        {
+            throw std::invalid_argument("Sequencer lead and tail must not be negative");
+        }
+    }
+
+    /**
+     * @brief Builds the combined key and T/R schedule.
+     *
+     * The first T/R assertion is at time zero and the first key-down at
+     * `lead`. Events are in time order; at equal times T/R-on precedes
+     * key-down and key-up precedes T/R-off.
+     *
+     * @param timeline Encoded message.
+     * @param wpm      Speed in words per minute (PARIS).
+     * @return The schedule.
+     */
+    std::vector<Event> schedule(const MorseTimeline &timeline, double wpm) const
+    {
+        const auto durations = timeline.durations(wpm);
+        const auto &runs = timeline.runs();
+
+        std::vector<Event> events;
+        events.reserve(runs.size() + 2);
+
+        std::chrono::microseconds now = leadTime;
+        std::chrono::microseconds releaseAt{0};
+        bool asserted = false;
+        for (size_t i = 0; i < runs.size(); ++i)
+        {
+            if (runs[i].keyDown)
+            {
+                if (asserted && now - leadTime > releaseAt)
+                {
+                    events.push_back({releaseAt, Line::TR, false});
+                    asserted = false;
+                }
+                if (!asserted)
+                {
+                    events.push_back({now - leadTime, Line::TR, true});
+                    asserted = true;
+                }
+                events.push_back({now, Line::Key, true});
+                events.push_back({now + durations[i], Line::Key, false});
+                releaseAt = now + durations[i] + tailTime;
+            }
+            now += durations[i];
+        }
+
+        if (asserted)
+        {
+            events.push_back({releaseAt, Line::TR, false});
+        }
+        return events;
+    }
+
+private:
+    std::chrono::microseconds leadTime;
+    std::chrono::microseconds tailTime;
+};
+
+#endif // MORSE_SEQUENCER_HPP
@@ -0,0 +1,277 @@
+/**
+ * @file MorseString.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_STRING_HPP
+#define MORSE_STRING_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MorseString
+ * @brief Result string with a large inline buffer.
+ *
+ * Encoded Morse is roughly ten times longer than its text, so a typical
+ * exchange such as "5NN 042 TU K1ABC" needs around 150 bytes, well past
+ * the inline capacity of std::string. MorseString holds up to
+ * inlineCapacity characters without touching the heap and only spills to
+ * an allocation for longer messages.
+ *
+ * It converts implicitly to std::string_view and std::string, and compares
+ * equal to anything that converts to std::string_view.
+ */
+class MorseString
+{
+public:
+    /**
+     * @brief Characters stored without a heap allocation.
+     */
+    static constexpr size_t inlineCapacity = 256;
+
+    /**
+     * @brief Constructs an empty string.
+     */
+    MorseString() noexcept
+    {
+        buffer[0] = '\0';
+    }
+
+    /**
+     * @brief Constructs a string holding a copy of the given text.
+     *
+     * @param text Text to copy.
+     */
+    explicit MorseString(std::string_view text)
+    {
+        buffer[0] = '\0';
+        *this += text;
+    }
+
+    MorseString(const MorseString &other)
+    {
+        buffer[0] = '\0';
+        *this += other.view();
+    }
+
+    MorseString(MorseString &&other) noexcept
+    {
+        buffer[0] = '\0';
+        take(other);
+    }
+
+    MorseString &operator=(const MorseString &other)
+    {
+        if (this != &other)
+        {
+            clear();
+            *this += other.view();
+        }
+        return *this;
+    }
+
+    MorseString &operator=(MorseString &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~MorseString()
+    {
+        release();
+    }
+
+    const char *data() const noexcept { return ptr; }
+    const char *c_str() const noexcept { return ptr; }
+    size_t size() const noexcept { return length; }
+    size_t capacity() const noexcept { return cap; }
+    bool empty() const noexcept { return length == 0; }
+
+    /**
+     * @brief Returns true while the contents live in the inline buffer.
+     */
+    bool isInline() const noexcept { return ptr == buffer; }
+
+    std::string_view view() const noexcept { return std::string_view(ptr, length); }
+    std::string str() const { return std::string(ptr, length); }
+    operator std::string_view() const noexcept { return view(); }
+    operator std::string() const { return str(); }
+
+    char operator[](size_t index) const noexcept { return ptr[index]; }
+
+    /**
+     * @brief Empties the string, keeping its storage.
+     */
+    void clear() noexcept
+    {
+        length = 0;
+        ptr[0] = '\0';
+    }
+
+    /**
+     * @brief Ensures room for at least the given number of characters.
+     *
+     * @param wanted Required capacity, not counting the terminator.
+     */
+    void reserve(size_t wanted)
+    {
+        if (wanted <= cap)
+        {
+            return;
+        }
+        const size_t grown = std::max(wanted, cap * 2);
+        char *heap = new char[grown + 1];
+        std::memcpy(heap, ptr, length + 1);
+        if (ptr != buffer)
+        {
+            delete[] ptr;
+        }
+        ptr = heap;
+        cap = grown;
+    }
+
+    /**
+     * @brief Truncates or extends the string; new characters are '\0'.
+     *
+     * @param count New length.
+     */
+    void resize(size_t count)
+    {
+        reserve(count);
+        if (count > length)
+        {
+            std::memset(ptr + length, '\0', count - length);
+        }
+        length = count;
+        ptr[length] = '\0';
+    }
+
+    MorseString &operator+=(std::string_view text)
+    {
+        if (text.data() >= ptr && text.data() < ptr + length)
+        {
+            // Appending part of ourselves; reserve() may move it.
+            const size_t offset = static_cast<size_t>(text.data() - ptr);
+            reserve(length + text.size());
+            text = std::string_view(ptr + offset, text.size());
+        }
+        reserve(length + text.size());
+        std::memcpy(ptr + length, text.data(), text.size());
+        length += text.size();
+        ptr[length] = '\0';
+        return *this;
+    }
+
+    MorseString &operator+=(char c)
+    {
+        reserve(length + 1);
+        ptr[length++] = c;
+        ptr[length] = '\0';
+        return *this;
+    }
+
+    friend bool operator==(const MorseString &lhs, const MorseString &rhs) noexcept
+    {
+        return lhs.view() == rhs.view();
+    }
+
+    friend bool operator==(const MorseString &lhs, std::string_view rhs) noexcept
+    {
+        return lhs.view() == rhs;
+    }
+
+    friend bool operator==(std::string_view lhs, const MorseString &rhs) noexcept
+    {
+        return lhs == rhs.view();
+    }
+
+    friend bool operator!=(const MorseString &lhs, const MorseString &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator!=(const MorseString &lhs, std::string_view rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator!=(std::string_view lhs, const MorseString &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const MorseString &text)
+    {
+        return os << text.view();
+    }
+
+private:
+    char *ptr = buffer;
+    size_t length = 0;
+    size_t cap = inlineCapacity;
+    char buffer[inlineCapacity + 1];
+
+    void release() noexcept
+    {
+        if (ptr != buffer)
+        {
+            delete[] ptr;
+            ptr = buffer;
+            cap = inlineCapacity;
+        }
+        length = 0;
+        buffer[0] = '\0';
+    }
+
+    void take(MorseString &other) noexcept
+    {
+        if (other.ptr == other.buffer)
+        {
+            std::memcpy(buffer, other.buffer, other.length + 1);
+            length = other.length;
+        }
+        else
+        {
+            ptr = other.ptr;
+            cap = other.cap;
+            length = other.length;
+            other.ptr = other.buffer;
+            other.cap = inlineCapacity;
+        }
+        other.length = 0;
+        other.buffer[0] = '\0';
+    }
+};
+
+#endif // MORSE_STRING_HPP
@@ -0,0 +1,269 @@
+/**
+ * @file MorseTemplate.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_TEMPLATE_HPP
+#define MORSE_TEMPLATE_HPP
+
+#include "MorseCodeGenerator.hpp"
+
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class MorseTemplate
+ * @brief Pre-encodes the fixed text of a message with variable fields.
+ *
+ * A template is plain message text with fields written as `{name}`, for
+ * example "5NN {nr} TU". Words made only of fixed text are encoded once
+ * when the template is compiled. Each render copies those
+ * segments and encodes only the words that contain a field, so the cost
+ * of a send grows with the field values rather than the whole message.
+ *
+ * The output is identical to MorseCodeGenerator::getMessage() for the
+ * substituted text, including word gaps at every join.
+ */
+class MorseTemplate
+{
+public:
+    /**
+     * @brief Compiles a template.
+     *
+     * @param text Template text with fields written as `{name}`.
+     * @throws std::invalid_argument On a malformed field or an unsupported
+     *         character in the fixed text.
+     */
+    explicit MorseTemplate(std::string_view text)
+    {
+        compile(text);
+    }
+
+    /**
+     * @brief Returns the field names in the order renderPositional() expects them.
+     */
+    const std::vector<std::string> &fields() const
+    {
+        return fieldNames;
+    }
+
+    /**
+     * @brief Renders the template with positional field values.
+     *
+     * @param values One value per entry of fields(), in the same order.
+     * @throws std::invalid_argument On a wrong value count or an unsupported
+     *         character in a field value.
+     * @return Morse-encoded message in the getMessage() format.
+     */
+    MorseString renderPositional(const std::vector<std::string_view> &values) const
+    {
+        if (values.size() != fieldNames.size())
+        {
+            throw std::invalid_argument("Template expects " + std::to_string(fieldNames.size()) +
+                                        " field values, got " + std::to_string(values.size()));
+        }
+
+        MorseString result;
+        result.reserve(fixedLength + 32);
+        MorseString word;
+
+        for (const auto &segment : segments)
+        {
+            if (segment.fields.empty())
+            {
+                appendGap(result);
+                result += segment.morse;
+                continue;
+            }
+
+            // Substitute, then split in case a value carries whitespace.
+            word.clear();
+            word += segment.literals[0];
+            for (size_t i = 0; i < segment.fields.size(); ++i)
+            {
+                word += values[segment.fields[i]];
+                word += segment.literals[i + 1];
+            }
+
+            size_t pos = 0;
+            while (pos < word.size())
+            {
+                while (pos < word.size() && std::isspace(static_cast<unsigned char>(word[pos])))
+                {
+                    ++pos;
+                }
+                size_t end = pos;
+                while (end < word.size() && !std::isspace(static_cast<unsigned char>(word[end])))
+                {
+                    ++end;
+                }
+                if (end > pos)
+                {
+                    appendGap(result);
+                    generator.encodeWord(word.view().substr(pos, end - pos), result);
+                }
+                pos = end;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Renders the template with named field values.
+     *
+     * @param values Map of field name to value.
+     * @throws std::invalid_argument If a field is missing or a value holds
+     *         an unsupported character.
+     * @return Morse-encoded message in the getMessage() format.
+     */
+    MorseString render(const std::unordered_map<std::string, std::string> &values) const
+    {
+        std::vector<std::string_view> ordered;
+        ordered.reserve(fieldNames.size());
+        for (const auto &name : fieldNames)
+        {
+            auto it = values.find(name);
+            if (it == values.end())
+            {
+                throw std::invalid_argument("Missing template field: " + name);
+            }
+            ordered.emplace_back(it->second);
+        }
+        return renderPositional(ordered);
+    }
+
+private:
+    /**
+     * @brief A run of fixed words, or one word containing fields.
+     *
+     * Fixed runs keep their pre-encoded Morse in `morse`. A field word
+     * keeps its text as literals[0] field[0] literals[1] ... literals[n].
+     */
+    struct Segment
+    {
+        std::string morse;
+        std::vector<std::string> literals;
+        std::vector<size_t> fields;
+    };
+
+    MorseCodeGenerator generator;
+    std::vector<Segment> segments;
+    std::vector<std::string> fieldNames;
+    size_t fixedLength = 0;
+
+    static void appendGap(MorseString &out)
+    {
+        if (!out.empty())
+        {
+            out += "       "; // 7 spaces between words
+        }
+    }
+
+    size_t fieldIndex(const std::string &name)
+    {
+        for (size_t i = 0; i < fieldNames.size(); ++i)
+        {
+            if (fieldNames[i] == name)
+            {
+                return i;
+            }
+        }
+        fieldNames.push_back(name);
+        return fieldNames.size() - 1;
+    }
+
+    void compile(std::string_view text)
+    {
+        size_t pos = 0;
+        while (pos < text.size())
+        {
+            while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+            {
+                ++pos;
+            }
+            if (pos == text.size())
+            {
+                break;
+            }
+
+            // A word runs to the next whitespace outside a field.
+            Segment word;
+            word.literals.emplace_back();
+            while (pos < text.size() && !std::isspace(static_cast<unsigned char>(text[pos])))
+            {
+                if (text[pos] == '{')
+                {
+                    size_t close = text.find('}', pos);
+                    if (close == std::string_view::npos)
+                    {
+                        throw std::invalid_argument("Unterminated template field");
+                    }
+                    std::string name(text.substr(pos + 1, close - pos - 1));
+                    if (name.empty() || name.find('{') != std::string::npos)
+                    {
+                        throw std::invalid_argument("Malformed template field: " + name);
+                    }
+                    word.fields.push_back(fieldIndex(name));
+                    word.literals.emplace_back();
+                    pos = close + 1;
+                }
+                else
+                {
+                    word.literals.back() += text[pos++];
+                }
+            }
+
+            if (!word.fields.empty())
+            {
+                segments.push_back(std::move(word));
+                continue;
+            }
+
+            // Merge consecutive fixed words into one pre-encoded segment.
+            if (segments.empty() || !segments.back().fields.empty())
+            {
+                segments.emplace_back();
+            }
+            else
+            {
+                segments.back().morse += "       ";
+            }
+            generator.encodeWord(word.literals[0], segments.back().morse);
+        }
+
+        for (const auto &segment : segments)
+        {
+            fixedLength += segment.morse.size() + 7;
+        }
+    }
+};
+
+#endif // MORSE_TEMPLATE_HPP
@@ -0,0 +1,174 @@
+/**
+ * @file MorseTimeline.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_TIMELINE_HPP
+#define MORSE_TIMELINE_HPP
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class MorseTimeline
+ * @brief Speed-independent key-down/key-up timeline in dit units.
+ *
+ * Built once from the output of getMessage(), the timeline holds
+ * alternating key-down and key-up runs measured in dit units. Timings for
+ * any speed are then a multiplication per run, so the same encoding can
+ * be played at many speeds without repeating any lookup or parsing.
+ *
+ * Speeds use the PARIS standard: one dit lasts 1.2 / WPM seconds.
+ */
+class MorseTimeline
+{
+public:
+    /**
+     * @brief One key-down or key-up run.
+     */
+    struct Run
+    {
+        bool keyDown;
+        uint32_t units;
+    };
+
+    /**
+     * @brief Parses a Morse string into runs.
+     *
+     * @param morse Morse string in the getMessage() format.
+     * @throws std::invalid_argument If the string holds anything other than
+     *         '.', '-', and ' '.
+     */
+    explicit MorseTimeline(std::string_view morse)
+    {
+        for (char c : morse)
+        {
+            if (c != '.' && c != '-' && c != ' ')
+            {
+                throw std::invalid_argument("Unsupported Morse element: " + std::string(1, c));
+            }
+            const bool down = (c != ' ');
+            const uint32_t units = (c == '-') ? 3 : 1;
+
+            // Adjacent key-up runs merge; key-down elements never touch.
+            if (!down && !timeline.empty() && !timeline.back().keyDown)
+            {
+                timeline.back().units += units;
+            }
+            else
+            {
+                timeline.push_back({down, units});
+            }
+            total += units;
+        }
+    }
+
+    /**
+     * @brief Returns the runs in order.
+     */
+    const std::vector<Run> &runs() const
+    {
+        return timeline;
+    }
+
+    /**
+     * @brief Returns the length of the timeline in dit units.
+     */
+    uint64_t totalUnits() const
+    {
+        return total;
+    }
+
+    /**
+     * @brief Returns the duration of one dit at the given speed.
+     *
+     * @param wpm Speed in words per minute (PARIS).
+     * @throws std::invalid_argument If wpm is not positive.
+     */
+    static std::chrono::duration<double> ditLength(double wpm)
+    {
+        if (!(wpm > 0.0))
+        {
+            throw std::invalid_argument("WPM must be positive");
+        }
+        return std::chrono::duration<double>(1.2 / wpm);
+    }
+
+    /**
+     * @brief Returns the duration of every run at one speed.
+     *
+     * Run boundaries are rounded from their exact cumulative position, so
+     * rounding error never accumulates over a long message.
+     *
+     * @param wpm Speed in words per minute (PARIS).
+     * @return One duration per entry of runs().
+     */
+    std::vector<std::chrono::microseconds> durations(double wpm) const
+    {
+        const double ditMicros = ditLength(wpm).count() * 1e6;
+        std::vector<std::chrono::microseconds> result;
+        result.reserve(timeline.size());
+
+        uint64_t units = 0;
+        int64_t previous = 0;
+        for (const auto &run : timeline)
+        {
+            units += run.units;
+            const int64_t edge = std::llround(static_cast<double>(units) * ditMicros);
+            result.emplace_back(edge - previous);
+            previous = edge;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns run durations for several speeds from this one timeline.
+     *
+     * @param wpms Speeds in words per minute (PARIS).
+     * @return One durations() vector per requested speed, in order.
+     */
+    std::vector<std::vector<std::chrono::microseconds>> durations(const std::vector<double> &wpms) const
+    {
+        std::vector<std::vector<std::chrono::microseconds>> result;
+        result.reserve(wpms.size());
+        for (double wpm : wpms)
+        {
+            result.push_back(durations(wpm));
+        }
+        return result;
+    }
+
+private:
+    std::vector<Run> timeline;
+    uint64_t total = 0;
+};
+
+#endif // MORSE_TIMELINE_HPP
@@ -0,0 +1,730 @@
+/**
+ * @file MorseTranscoder.hpp
+ *
+ * This project is is licensed under the MIT License. See LICENSE.MIT.md
+ * for more information.
+ *
+ * Copyright (C) 2025 Lee C. Bussy (@LBussy). All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+#ifndef MORSE_TRANSCODER_HPP
+#define MORSE_TRANSCODER_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define MORSE_TRANSCODER_BLOCKS 1
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#endif
+
+/**
+ * @class MorseTranscoder
+ * @brief Streams Morse between text notations without decoding characters.
+ *
+ * Supported formats:
+ *
+ * | Format  | Dit | Dah | Element gap | Letter gap | Word gap  |
+ * | ------- | --- | --- | ----------- | ---------- | --------- |
+ * | Spaced  | `.` | `-` | 1 space     | 3 spaces   | 7 spaces  |
+ * | Compact | `.` | `-` | (none)      | 1 space    | ` / `     |
+ * | Unicode | `·` | `−` | (none)      | 1 space    | ` / `     |
+ * | Units   | `1` | `111` | `0`       | `000`      | `0000000` |
+ *
+ * Spaced is the getMessage() format. Input is parsed straight into dits,
+ * dahs, and gaps and written out in the target notation, so no lookup
+ * table of letters is involved. Input may arrive in chunks of any size,
+ * including chunks that split a gap or a UTF-8 sequence.
+ *
+ * Spaced and Units input is checked strictly: marks must be separated,
+ * and a gap between marks must be exactly 1, 3, or 7 units, so anything
+ * written can be read back. Leading and trailing gaps are ignored.
+ *
+ * Spaced to Compact, the common case, is also done 64 bytes at a time:
+ * the block is classified into marks and gaps with bit masks, and the
+ * bytes to keep are packed with a byte shuffle (SSSE3 where the CPU has
+ * it). Blocks holding anything else take the byte-at-a-time path, which
+ * reports the error.
+ */
+class MorseTranscoder
+{
+public:
+    /**
+     * @brief Morse text notations.
+     */
+    enum class Format
+    {
+        Spaced,
+        Compact,
+        Unicode,
+        Units
+    };
+
+    /**
+     * @brief Creates a transcoder for one direction.
+     *
+     * @param from Input notation.
+     * @param to   Output notation.
+     */
+    MorseTranscoder(Format from, Format to)
+        : input(from),
+          expansion((from == Format::Spaced && (to == Format::Spaced || to == Format::Compact)) ? 1 : maxExpansion)
+    {
+#ifdef MORSE_TRANSCODER_BLOCKS
+        blocks = (from == Format::Spaced && to == Format::Compact);
+#if defined(__x86_64__) || defined(__i386__)
+        shuffle = __builtin_cpu_supports("ssse3");
+#endif
+#endif
+        // Output is table driven: one piece per mark and per gap length.
+        switch (to)
+        {
+        case Format::Spaced:
+            marks = {piece("."), piece("-")};
+            gaps[1] = piece(" ");
+            gaps[3] = piece("   ");
+            gaps[7] = piece("       ");
+            break;
+        case Format::Compact:
+            marks = {piece("."), piece("-")};
+            gaps[3] = piece(" ");
+            gaps[7] = piece(" / ");
+            break;
+        case Format::Unicode:
+            marks = {piece("\xC2\xB7"), piece("\xE2\x88\x92")};
+            gaps[3] = piece(" ");
+            gaps[7] = piece(" / ");
+            break;
+        case Format::Units:
+            marks = {piece("1"), piece("111")};
+            gaps[1] = piece("0");
+            gaps[3] = piece("000");
+            gaps[7] = piece("0000000");
+            break;
+        }
+    }
+
+    /**
+     * @brief Converts one chunk of input, appending to out.
+     *
+     * Output for a trailing gap or an unfinished run is held back until
+     * more input or finish() shows how it ends.
+     *
+     * @param chunk Next piece of input.
+     * @param out   String the converted text is appended to.
+     * @throws std::invalid_argument On a character or run the input format
+     *         does not allow.
+     */
+    void transcode(std::string_view chunk, std::string &out)
+    {
+        // Write through a raw cursor into worst-case space, then trim. Slices
+        // keep the zero-filled slack small enough to stay in cache.
+        static constexpr size_t slice = 16 * 1024;
+        for (size_t offset = 0; offset < chunk.size(); offset += slice)
+        {
+            const std::string_view part = chunk.substr(offset, slice);
+            const size_t used = out.size();
+            out.resize(used + part.size() * expansion + maxFlush);
+            char *cursor = &out[used];
+            try
+            {
+                switch (input)
+                {
+                case Format::Spaced:
+                    parseSpaced(part, cursor);
+                    break;
+                case Format::Compact:
+                case Format::Unicode:
+                    parseCompact(part, cursor);
+                    break;
+                case Format::Units:
+                    parseUnits(part, cursor);
+                    break;
+                }
+            }
+            catch (...)
+            {
+                out.resize(static_cast<size_t>(cursor - out.data()));
+                throw;
+            }
+            out.resize(static_cast<size_t>(cursor - out.data()));
+        }
+    }
+
+    /**
+     * @brief Flushes held-back output and resets for the next message.
+     *
+     * Trailing gaps are dropped, matching getMessage().
+     *
+     * @param out String the converted text is appended to.
+     * @throws std::invalid_argument If the input ended mid-element.
+     */
+    void finish(std::string &out)
+    {
+        if (utf8Need > 0)
+        {
+            throw std::invalid_argument("Truncated UTF-8 sequence");
+        }
+        if (input == Format::Units && runChar == '1')
+        {
+            const size_t used = out.size();
+            out.resize(used + maxFlush);
+            char *cursor = &out[used];
+            emitMark(markFromRun(runLength), cursor);
+            out.resize(static_cast<size_t>(cursor - out.data()));
+        }
+        pendingGap = 0;
+        runChar = 0;
+        runLength = 0;
+        lastWasMark = false;
+        started = false;
+    }
+
+    /**
+     * @brief Converts a complete message in one call.
+     */
+    static std::string convert(std::string_view text, Format from, Format to)
+    {
+        MorseTranscoder transcoder(from, to);
+        std::string out;
+        out.reserve(text.size() * transcoder.expansion + maxFlush);
+        transcoder.transcode(text, out);
+        transcoder.finish(out);
+        return out;
+    }
+
+private:
+    enum class Mark
+    {
+        Dit,
+        Dah
+    };
+
+    // Output bytes per input byte, worst case: "-" after a mark becomes
+    // "0111" in Units. Spaced to Spaced or Compact never grows, since every
+    // gap is written no longer than the spaces it came from. One pending gap
+    // plus one 8-byte store fit in maxFlush.
+    static constexpr size_t maxExpansion = 4;
+    static constexpr size_t maxFlush = 16;
+
+    struct Piece
+    {
+        char text[8];
+        uint8_t length;
+    };
+
+    Format input;
+    size_t expansion;
+    std::array<Piece, 2> marks{};
+    std::array<Piece, 8> gaps{};
+    uint32_t pendingGap = 0;
+    char runChar = 0;
+    uint64_t runLength = 0;
+    bool lastWasMark = false;
+    bool started = false;
+    int utf8Need = 0;
+    uint32_t codepoint = 0;
+    bool blocks = false;
+    bool shuffle = false;
+
+    static uint32_t checkedGap(uint64_t units)
+    {
+        if (units != 1 && units != 3 && units != 7)
+        {
+            throw std::invalid_argument("Key-up run of " + std::to_string(units) + " units");
+        }
+        return static_cast<uint32_t>(units);
+    }
+
+    static Mark markFromRun(uint64_t ones)
+    {
+        if (ones == 1)
+        {
+            return Mark::Dit;
+        }
+        if (ones == 3)
+        {
+            return Mark::Dah;
+        }
+        throw std::invalid_argument("Key-down run of " + std::to_string(ones) + " units");
+    }
+
+    void emitMark(Mark mark, char *&cursor)
+    {
+        if (started && pendingGap > 0)
+        {
+            emit(gaps[pendingGap], cursor);
+        }
+        pendingGap = 0;
+        started = true;
+        emit(marks[static_cast<size_t>(mark)], cursor);
+    }
+
+    /**
+     * @brief Copies a piece with one fixed-size store.
+     *
+     * transcode() always leaves maxFlush bytes of slack, so writing the
+     * whole 8-byte piece past a shorter one is safe.
+     */
+    static void emit(const Piece &piece, char *&cursor)
+    {
+        std::memcpy(cursor, piece.text, sizeof(piece.text));
+        cursor += piece.length;
+    }
+
+    static Piece piece(std::string_view text)
+    {
+        Piece result{};
+        std::memcpy(result.text, text.data(), text.size());
+        result.length = static_cast<uint8_t>(text.size());
+        return result;
+    }
+
+#ifdef MORSE_TRANSCODER_BLOCKS
+    static constexpr size_t blockSize = 64;
+
+    /**
+     * @brief Byte positions to keep from an 8-byte lane, per keep mask.
+     */
+    struct LaneShuffle
+    {
+        uint64_t index[256];
+        uint8_t count[256];
+    };
+
+    static constexpr LaneShuffle buildLaneShuffle()
+    {
+        LaneShuffle table{};
+        for (unsigned mask = 0; mask < 256; ++mask)
+        {
+            unsigned kept = 0;
+            for (unsigned bit = 0; bit < 8; ++bit)
+            {
+                if (mask & (1u << bit))
+                {
+                    table.index[mask] |= static_cast<uint64_t>(bit) << (8 * kept++);
+                }
+            }
+            table.count[mask] = static_cast<uint8_t>(kept);
+        }
+        return table;
+    }
+
+    static const LaneShuffle &laneShuffle()
+    {
+        static constexpr LaneShuffle table = buildLaneShuffle();
+        return table;
+    }
+
+    /**
+     * @brief Sets one bit per byte of a 64-byte block for spaces and marks.
+     */
+    static void blockMasks(const char *block, uint64_t &space, uint64_t &marks)
+    {
+        space = 0;
+        marks = 0;
+#if defined(__SSE2__)
+        const __m128i blank = _mm_set1_epi8(' ');
+        const __m128i dit = _mm_set1_epi8('.');
+        const __m128i dah = _mm_set1_epi8('-');
+        for (int k = 0; k < 4; ++k)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 16 * k));
+            const __m128i mark = _mm_or_si128(_mm_cmpeq_epi8(v, dit), _mm_cmpeq_epi8(v, dah));
+            space |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, blank)))) << (16 * k);
+            marks |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(mark))) << (16 * k);
+        }
+#else
+        for (int k = 0; k < 8; ++k)
+        {
+            uint64_t word;
+            std::memcpy(&word, block + 8 * k, sizeof(word));
+            space |= zeroBytes(word ^ 0x2020202020202020ULL) << (8 * k);
+            marks |= (zeroBytes(word ^ 0x2E2E2E2E2E2E2E2EULL) | zeroBytes(word ^ 0x2D2D2D2D2D2D2D2DULL)) << (8 * k);
+        }
+#endif
+    }
+
+#if !defined(__SSE2__)
+    /**
+     * @brief Returns one bit per zero byte of an 8-byte word.
+     */
+    static uint64_t zeroBytes(uint64_t word)
+    {
+        const uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+        // High bit of each zero byte, then gathered into the low 8 bits.
+        const uint64_t zero = ~(((word & low7) + low7) | word | low7);
+        return ((zero >> 7) * 0x0102040810204080ULL) >> 56;
+    }
+#endif
+
+    /**
+     * @brief Finds the bytes of a Spaced block that survive in Compact.
+     *
+     * The byte before the block must be a mark. The block is cut after
+     * its last mark so that every gap in it is complete; marks are kept,
+     * the middle space of a 3-space gap is kept, and the middle three of a
+     * 7-space gap are kept as " / ".
+     *
+     * @param block  64 bytes of input.
+     * @param keep   Receives the keep mask.
+     * @param slash  Receives the positions to write as '/'.
+     * @return Bytes consumed, or 0 if the block needs the byte loop.
+     */
+    static size_t classifyBlock(const char *block, uint64_t &keep, uint64_t &slash)
+    {
+        uint64_t space;
+        uint64_t marks;
+        blockMasks(block, space, marks);
+        // Anything else in the block, or two marks in a row, is an error the
+        // byte loop reports.
+        if ((space | marks) != ~0ULL || marks == 0 || (marks & ((marks << 1) | 1)) != 0)
+        {
+            return 0;
+        }
+        const size_t length = 64 - static_cast<size_t>(__builtin_clzll(marks));
+        if (length < 64)
+        {
+            space &= (1ULL << length) - 1;
+        }
+
+        const uint64_t start = space & ~(space << 1);
+        const uint64_t end = space & ~(space >> 1);
+        const uint64_t gap1 = start & end;
+        const uint64_t gap3 = start & ~(end | end >> 1) & (end >> 2);
+        const uint64_t gap7 = start & ~(end | end >> 1 | end >> 2 | end >> 3 | end >> 4 | end >> 5) & (end >> 6);
+        if ((gap1 | gap3 | gap7) != start)
+        {
+            return 0;
+        }
+        keep = marks | (gap3 << 1) | (gap7 << 2) | (gap7 << 3) | (gap7 << 4);
+        slash = gap7 << 3;
+        return length;
+    }
+
+    /**
+     * @brief Returns the block to pack from, copied to lanes with '/' at
+     *        the given positions if there are any.
+     */
+    static const char *loadBlock(const char *block, uint64_t slash, char *lanes)
+    {
+        if (slash == 0)
+        {
+            return block;
+        }
+        std::memcpy(lanes, block, blockSize);
+        while (slash)
+        {
+            lanes[__builtin_ctzll(slash)] = '/';
+            slash &= slash - 1;
+        }
+        return lanes;
+    }
+
+    /**
+     * @brief Converts whole Spaced blocks to Compact, packing bytes one
+     *        lane at a time.
+     *
+     * Each lane is written with 8 byte stores, so up to 7 bytes past the
+     * output are overwritten; transcode() leaves room for that.
+     *
+     * @return Bytes consumed; stops at the first block that needs the
+     *         byte loop or when less than a block remains.
+     */
+    static size_t compactBlocks(const char *p, size_t n, char *&cursor)
+    {
+        char *out = cursor;
+        size_t i = 0;
+        alignas(16) char lanes[blockSize];
+        uint64_t keep;
+        uint64_t slash;
+        while (n - i >= blockSize)
+        {
+            const size_t length = classifyBlock(p + i, keep, slash);
+            if (length == 0)
+            {
+                break;
+            }
+            const char *source = loadBlock(p + i, slash, lanes);
+            const LaneShuffle &table = laneShuffle();
+            for (size_t lane = 0; lane < blockSize; lane += 8, keep >>= 8)
+            {
+                const unsigned mask = static_cast<unsigned>(keep & 0xFF);
+                const uint64_t index = table.index[mask];
+                for (unsigned b = 0; b < 8; ++b)
+                {
+                    out[b] = source[lane + ((index >> (8 * b)) & 7)];
+                }
+                out += table.count[mask];
+            }
+            i += length;
+        }
+        cursor = out;
+        return i;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    /**
+     * @brief compactBlocks() using one SSSE3 byte shuffle per lane.
+     */
+    __attribute__((target("ssse3"))) static size_t compactBlocksShuffle(const char *p, size_t n, char *&cursor)
+    {
+        char *out = cursor;
+        size_t i = 0;
+        alignas(16) char lanes[blockSize];
+        uint64_t keep;
+        uint64_t slash;
+        while (n - i >= blockSize)
+        {
+            const size_t length = classifyBlock(p + i, keep, slash);
+            if (length == 0)
+            {
+                break;
+            }
+            const char *source = loadBlock(p + i, slash, lanes);
+            const LaneShuffle &table = laneShuffle();
+            for (size_t lane = 0; lane < blockSize; lane += 8, keep >>= 8)
+            {
+                const unsigned mask = static_cast<unsigned>(keep & 0xFF);
+                const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + lane));
+                const __m128i index = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&table.index[mask]));
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi8(bytes, index));
+                out += table.count[mask];
+            }
+            i += length;
+        }
+        cursor = out;
+        return i;
+    }
+#else
+    static size_t compactBlocksShuffle(const char *p, size_t n, char *&out)
+    {
+        return compactBlocks(p, n, out);
+    }
+#endif
+#endif
+
+    void parseSpaced(std::string_view chunk, char *&cursor)
+    {
+        // Work on locals: stores through the char cursor may alias members,
+        // which would otherwise force a reload on every byte.
+        char *out = cursor;
+        uint64_t run = runLength;
+        bool begun = started;
+        bool afterMark = lastWasMark;
+        const char *p = chunk.data();
+        const size_t n = chunk.size();
+        size_t i = 0;
+
+        const auto fail = [&](const std::string &message)
+        {
+            cursor = out;
+            runLength = run;
+            started = begun;
+            lastWasMark = afterMark;
+            throw std::invalid_argument(message);
+        };
+
+#ifdef MORSE_TRANSCODER_BLOCKS
+        size_t retry = 0;
+#endif
+
+        while (i < n)
+        {
+#ifdef MORSE_TRANSCODER_BLOCKS
+            // Whole blocks need the last byte taken to be a mark. A block that
+            // fails is not retried until the byte loop has moved past it.
+            if (blocks && afterMark && i >= retry && n - i >= blockSize)
+            {
+                const size_t taken = shuffle ? compactBlocksShuffle(p + i, n - i, out)
+                                             : compactBlocks(p + i, n - i, out);
+                i += taken;
+                retry = i + blockSize;
+                if (i == n)
+                {
+                    break;
+                }
+            }
+            // Fast path: after a mark, measure the gap with one 8-byte load
+            // instead of a branch per space, then take the mark behind it.
+            // Anything but a 1, 3, or 7 space gap followed by a mark, and the
+            // last few bytes, go to the byte loop.
+            while (afterMark && i + 8 <= n)
+            {
+                uint64_t ahead;
+                std::memcpy(&ahead, p + i, sizeof(ahead));
+                const uint64_t other = ahead ^ 0x2020202020202020ULL;
+                const size_t spaces = other ? static_cast<size_t>(__builtin_ctzll(other)) / 8 : 8;
+                if ((spaces != 1 && spaces != 3 && spaces != 7) || (p[i + spaces] != '.' && p[i + spaces] != '-'))
+                {
+                    break;
+                }
+                emit(gaps[spaces], out);
+                emit(marks[p[i + spaces] == '-'], out);
+                i += spaces + 1;
+            }
+            if (i == n)
+            {
+                break;
+            }
+#endif
+            const char c = p[i++];
+            if (c == ' ')
+            {
+                ++run;
+                afterMark = false;
+                continue;
+            }
+            if (c != '.' && c != '-')
+            {
+                fail("Unsupported Morse element: " + std::string(1, c));
+            }
+            if (afterMark)
+            {
+                fail("Marks with no gap between them");
+            }
+            if (run > 0 && begun)
+            {
+                emit(gaps[checkedGap(run)], out);
+            }
+            run = 0;
+            begun = true;
+            afterMark = true;
+            emit(marks[c == '-'], out);
+        }
+        cursor = out;
+        runLength = run;
+        started = begun;
+        lastWasMark = afterMark;
+    }
+
+    void markOrGap(Mark mark, char *&cursor)
+    {
+        if (pendingGap == 0 && lastWasMark)
+        {
+            pendingGap = 1;
+        }
+        emitMark(mark, cursor);
+        lastWasMark = true;
+    }
+
+    void parseCompact(std::string_view chunk, char *&cursor)
+    {
+        for (char c : chunk)
+        {
+            const unsigned char byte = static_cast<unsigned char>(c);
+            if (utf8Need > 0)
+            {
+                if ((byte & 0xC0) != 0x80)
+                {
+                    throw std::invalid_argument("Malformed UTF-8 sequence");
+                }
+                codepoint = (codepoint << 6) | (byte & 0x3F);
+                if (--utf8Need > 0)
+                {
+                    continue;
+                }
+                if (codepoint == 0x00B7)
+                {
+                    markOrGap(Mark::Dit, cursor);
+                }
+                else if (codepoint == 0x2212)
+                {
+                    markOrGap(Mark::Dah, cursor);
+                }
+                else
+                {
+                    throw std::invalid_argument("Unsupported Morse symbol in UTF-8 input");
+                }
+                continue;
+            }
+
+            switch (c)
+            {
+            case '.':
+                markOrGap(Mark::Dit, cursor);
+                break;
+            case '-':
+                markOrGap(Mark::Dah, cursor);
+                break;
+            case ' ':
+                pendingGap = (pendingGap == 7) ? 7 : 3;
+                lastWasMark = false;
+                break;
+            case '/':
+                pendingGap = 7;
+                lastWasMark = false;
+                break;
+            default:
+                if ((byte & 0xE0) == 0xC0)
+                {
+                    utf8Need = 1;
+                    codepoint = byte & 0x1F;
+                }
+                else if ((byte & 0xF0) == 0xE0)
+                {
+                    utf8Need = 2;
+                    codepoint = byte & 0x0F;
+                }
+                else
+                {
+                    throw std::invalid_argument("Unsupported Morse element: " + std::string(1, c));
+                }
+                break;
+            }
+        }
+    }
+
+    void parseUnits(std::string_view chunk, char *&cursor)
+    {
+        for (char c : chunk)
+        {
+            if (c != '0' && c != '1')
+            {
+                throw std::invalid_argument("Unsupported unit symbol: " + std::string(1, c));
+            }
+            if (c == runChar)
+            {
+                ++runLength;
+                continue;
+            }
+            if (runChar == '1')
+            {
+                emitMark(markFromRun(runLength), cursor);
+            }
+            else if (runChar == '0')
+            {
+                pendingGap = started ? checkedGap(runLength) : 0;
+            }
+            runChar = c;
+            runLength = 1;
+        }
+    }
+};
+
+#endif // MORSE_TRANSCODER_HPP
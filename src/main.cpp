@@ -7,8 +7,113 @@
  */
 
 #include "MorseCodeGenerator.hpp"
+#include "MorseTemplate.hpp"
+#include "MorseData.hpp"
+#include "MorseTimeline.hpp"
+#include "MorseSequencer.hpp"
+#include "MorseAbbreviator.hpp"
+#include "MorseTranscoder.hpp"
+#include "MorseBeacon.hpp"
 #include <iostream>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef MORSE_BEACON_SUPPORTED
+#include <sys/prctl.h>
+#endif
+
+// Counts heap allocations so the tests can check results stay inline. The
+// replacements are kept out of line: once inlined, GCC pairs malloc/free
+// with new/delete and fails the build with -Wmismatched-new-delete.
+static size_t allocations = 0;
+
+__attribute__((noinline)) void *operator new(std::size_t size)
+{
+    ++allocations;
+    if (void *p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+__attribute__((noinline)) void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+__attribute__((noinline)) void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+__attribute__((noinline)) void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+__attribute__((noinline)) void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+/**
+ * @brief Checks that T/R brackets every key-down by the lead and tail.
+ *
+ * @return Number of T/R windows in the schedule.
+ */
+static size_t checkSequence(const std::vector<MorseSequencer::Event> &events,
+                            std::chrono::microseconds lead, std::chrono::microseconds tail)
+{
+    [[maybe_unused]] bool tr = false;
+    [[maybe_unused]] bool key = false;
+    size_t windows = 0;
+    std::chrono::microseconds trOn{0};
+    std::chrono::microseconds keyUp{0};
+    std::chrono::microseconds last{0};
+    for (const auto &event : events)
+    {
+        assert(event.at >= last);
+        last = event.at;
+        if (event.line == MorseSequencer::Line::TR)
+        {
+            assert(event.on != tr && !key);
+            if (event.on)
+            {
+                trOn = event.at;
+                ++windows;
+            }
+            else
+            {
+                assert(event.at - keyUp >= tail);
+            }
+            tr = event.on;
+        }
+        else
+        {
+            assert(tr && event.on != key);
+            if (event.on)
+            {
+                assert(event.at - trOn >= lead);
+            }
+            else
+            {
+                keyUp = event.at;
+            }
+            key = event.on;
+        }
+    }
+    assert(!tr && !key);
+    return windows;
+}
 
 /**
  * @brief Main entry point for Morse code translator test.
@@ -17,6 +122,14 @@
  * - Full message translation
  * - Word-by-word iteration
  * - Assertion-based prosign testing
+ * - Allocation-free results for typical messages
+ * - Template rendering against full translation
+ * - Binary data frames, FEC recovery, and airtime against hex
+ * - One timeline played at several speeds
+ * - T/R sequencing lead and tail guarantees
+ * - Airtime saved by abbreviations and cut numbers
+ * - Transcoding between Morse notations, whole and chunked
+ * - Beacon wakeups and CPU time per transmission (Linux)
  * - Exception handling for unsupported characters
  *
  * @return int 0 if successful, non-zero on unexpected error.
@@ -45,6 +158,233 @@ int main() {
 
         std::cout << "[Test Passed] Prosign test successful." << std::endl;
 
+        std::cout << "[Test] Results for CQ TEST DE K1ABC stay inline" << std::endl;
+        morse_message.setMessage(std::string("CQ TEST DE K1ABC"));
+        [[maybe_unused]] const size_t before = allocations;
+        MorseString full = morse_message.getMessage();
+        MorseString first = morse_message.getNext();
+        assert(allocations == before);
+        assert(full.isInline() && first.isInline());
+        assert(full.view().substr(0, first.size()) == first);
+
+        morse_message.setMessage(std::string(40, '0'));
+        MorseString spilled = morse_message.getMessage();
+        assert(!spilled.isInline());
+        assert(spilled.size() == 40 * 9 + 39 * 3);
+
+        std::cout << "[Test Passed] Inline result test successful." << std::endl;
+
+        std::cout << "[Test] Template 5NN {nr} TU {call}/{nr}" << std::endl;
+        MorseTemplate exchange("5NN {nr} TU {call}/{nr}");
+        assert(exchange.fields().size() == 2);
+        morse_message.setMessage(std::string("5NN 042 TU K1ABC/042"));
+        assert(exchange.render({{"nr", "042"}, {"call", "k1abc"}}) == morse_message.getMessage());
+        morse_message.setMessage(std::string("5NN 1 2 TU K1ABC/1 2"));
+        assert(exchange.renderPositional({"1 2", "K1ABC"}) == morse_message.getMessage());
+        std::cout << exchange.renderPositional({"042", "K1ABC"}) << std::endl;
+        MorseTemplate serial("5NN {nr}");
+        morse_message.setMessage(std::string("5NN 042"));
+        assert(serial.render({{"nr", "042"}}) == morse_message.getMessage());
+        assert(serial.renderPositional({"042"}) == morse_message.getMessage());
+
+        std::cout << "[Test Passed] Template test successful." << std::endl;
+
+        std::cout << "[Test] Data frame round trip" << std::endl;
+        const std::vector<uint8_t> telemetry{0x12, 0x34, 0x00, 0xFF, 0x7E, 0x81, 0x42, 0x99};
+        MorseData data;
+        std::string frame = data.encode(telemetry);
+        assert(data.decode(frame) == telemetry);
+
+        MorseData dataFec(true);
+        std::string fecFrame = dataFec.encode(telemetry);
+        fecFrame.replace(0, fecFrame.find("   "), ". . . . . ."); // unreadable first character
+        assert(dataFec.decode(fecFrame) == telemetry);
+
+        std::string hex;
+        for (uint8_t byte : telemetry)
+        {
+            char digits[3];
+            std::snprintf(digits, sizeof(digits), "%02X", byte);
+            hex += digits;
+        }
+        morse_message.setMessage(hex);
+        const size_t hexUnits = MorseCodeGenerator::countUnits(morse_message.getMessage());
+        std::cout << "Airtime units: hex " << hexUnits
+                  << ", frame " << MorseCodeGenerator::countUnits(frame)
+                  << ", frame+FEC " << MorseCodeGenerator::countUnits(dataFec.encode(telemetry)) << std::endl;
+
+        std::cout << "[Test Passed] Data frame test successful." << std::endl;
+
+        std::cout << "[Test] Timeline for PARIS at 10-30 WPM" << std::endl;
+        morse_message.setMessage(std::string("PARIS"));
+        MorseString paris = morse_message.getMessage();
+        MorseTimeline timeline(paris);
+        assert(timeline.totalUnits() == MorseCodeGenerator::countUnits(paris));
+        assert(timeline.runs().front().keyDown && timeline.runs().back().keyDown);
+
+        const std::vector<double> speeds{10, 15, 20, 25, 30};
+        const auto variants = timeline.durations(speeds);
+        for (size_t i = 0; i < speeds.size(); ++i)
+        {
+            std::chrono::microseconds length{0};
+            for (auto run : variants[i])
+            {
+                length += run;
+            }
+            assert(length.count() == std::llround(timeline.totalUnits() * 1.2e6 / speeds[i]));
+            std::cout << speeds[i] << " WPM: " << length.count() / 1000 << " ms" << std::endl;
+        }
+
+        std::cout << "[Test Passed] Timeline test successful." << std::endl;
+
+        std::cout << "[Test] T/R sequencing for CQ DE K at 20 WPM" << std::endl;
+        morse_message.setMessage(std::string("CQ DE K"));
+        MorseTimeline cq(morse_message.getMessage());
+        using std::chrono::milliseconds;
+
+        MorseSequencer qsk(milliseconds(5), milliseconds(10));
+        const size_t qskWindows = checkSequence(qsk.schedule(cq, 20), milliseconds(5), milliseconds(10));
+
+        MorseSequencer semi(milliseconds(20), milliseconds(400));
+        const size_t semiWindows = checkSequence(semi.schedule(cq, 20), milliseconds(20), milliseconds(400));
+        assert(semiWindows == 1);
+
+        std::cout << "QSK windows: " << qskWindows << ", semi break-in windows: " << semiWindows << std::endl;
+        std::cout << "[Test Passed] Sequencer test successful." << std::endl;
+
+        std::cout << "[Test] Abbreviate THANKS FOR THE REPORT UR RST 599 NR 0100" << std::endl;
+        const std::string longhand("thanks for the report ur rst 599 nr 0100");
+        MorseAbbreviator abbreviator;
+        const auto shorter = abbreviator.optimize(longhand);
+        assert(shorter.text == "TNX FER THE RPT UR RST 5NN NR T1TT");
+        morse_message.setMessage(longhand);
+        assert(shorter.originalUnits == MorseCodeGenerator::countUnits(morse_message.getMessage()));
+        morse_message.setMessage(shorter.text);
+        assert(shorter.units == MorseCodeGenerator::countUnits(morse_message.getMessage()));
+        const MorseAbbreviator fullCuts(true);
+        assert(fullCuts.optimize("NR 0100").text == "NR 0ATT");
+        assert(fullCuts.optimize("RST 599").text == "RST 5NN");
+        assert(fullCuts.optimize("NR 70").text == "NR 7T");
+        assert(fullCuts.optimize("QTH 70 70").text == "QTH 70 70");
+        assert(fullCuts.optimize("73").text == "73");
+        assert(fullCuts.optimize("NR 73").text == "NR 73");
+        assert(fullCuts.optimize("1").text == "1");
+        assert(abbreviator.optimize("QRG 7030").text == "QRG 7030");
+        assert(abbreviator.optimize("AGE 19").text == "AGE 19");
+        assert(abbreviator.optimize("GOOD MORNING OM").text == "GM OM");
+
+        std::cout << shorter.text << " (" << shorter.originalUnits << " -> " << shorter.units
+                  << " units)" << std::endl;
+        std::cout << "[Test Passed] Abbreviation test successful." << std::endl;
+
+        std::cout << "[Test] Transcode CQ DE K between notations" << std::endl;
+        using Format = MorseTranscoder::Format;
+        morse_message.setMessage(std::string("CQ DE K"));
+        const std::string spaced = morse_message.getMessage();
+        assert(MorseTranscoder::convert(spaced, Format::Spaced, Format::Compact) == "-.-. --.- / -.. . / -.-");
+        assert(MorseTranscoder::convert(spaced, Format::Spaced, Format::Unicode) ==
+               "\u2212\u00B7\u2212\u00B7 \u2212\u2212\u00B7\u2212 / \u2212\u00B7\u00B7 \u00B7 / \u2212\u00B7\u2212");
+        const std::string units = MorseTranscoder::convert(spaced, Format::Spaced, Format::Units);
+        assert(units.size() == MorseCodeGenerator::countUnits(spaced));
+        for (Format format : {Format::Compact, Format::Unicode, Format::Units})
+        {
+            const std::string other = MorseTranscoder::convert(spaced, Format::Spaced, format);
+            assert(MorseTranscoder::convert(other, format, Format::Spaced) == spaced);
+
+            MorseTranscoder bytewise(format, Format::Spaced);
+            std::string streamed;
+            for (char c : other)
+            {
+                bytewise.transcode(std::string_view(&c, 1), streamed);
+            }
+            bytewise.finish(streamed);
+            assert(streamed == spaced);
+        }
+
+        // Long enough for whole 64-byte blocks.
+        std::string bulk;
+        for (int i = 0; i < 64; ++i)
+        {
+            bulk += spaced;
+            bulk += "       ";
+        }
+        MorseTranscoder bytewise(Format::Spaced, Format::Compact);
+        std::string streamed;
+        for (char c : bulk)
+        {
+            bytewise.transcode(std::string_view(&c, 1), streamed);
+        }
+        bytewise.finish(streamed);
+        const std::string compact = MorseTranscoder::convert(bulk, Format::Spaced, Format::Compact);
+        assert(compact == streamed);
+
+        // Gaps must be 1, 3, or 7 units and marks must be separated, on the
+        // block, fast, and byte paths alike.
+        std::string broken = bulk;
+        broken.replace(bulk.size() / 2, 7, "     ");
+        for (const std::string &bad : {std::string(".."), std::string("..  ."), std::string(".    -"),
+                                       std::string(".        ."), broken, broken.replace(9, 1, ".")})
+        {
+            for (Format format : {Format::Compact, Format::Units})
+            {
+                [[maybe_unused]] bool threw = false;
+                try
+                {
+                    MorseTranscoder::convert(bad, Format::Spaced, format);
+                }
+                catch (const std::invalid_argument &)
+                {
+                    threw = true;
+                }
+                assert(threw);
+            }
+        }
+        for (const char *bad : {"1001", "100001", "1000000001", "11"})
+        {
+            [[maybe_unused]] bool threw = false;
+            try
+            {
+                MorseTranscoder::convert(bad, Format::Units, Format::Spaced);
+            }
+            catch (const std::invalid_argument &)
+            {
+                threw = true;
+            }
+            assert(threw);
+        }
+
+        std::cout << "[Test Passed] Transcoder test successful." << std::endl;
+
+#ifdef MORSE_BEACON_SUPPORTED
+        std::cout << "[Test] Beacon sends E three times at 60 WPM" << std::endl;
+        morse_message.setMessage(std::string("E"));
+        MorseBeacon beacon(MorseTimeline(morse_message.getMessage()), 60,
+                           MorseSequencer(milliseconds(2), milliseconds(5)), milliseconds(80), milliseconds(20));
+        size_t keyDowns = 0;
+        const auto power = beacon.run(3, [&](MorseSequencer::Line line, bool on)
+                                      { keyDowns += (line == MorseSequencer::Line::Key && on); });
+        assert(keyDowns == 3 && power.transmissions == 3);
+        assert(power.wakeups >= 3 * 5); // idle, align, key on, key off, T/R off
+        std::cout << "Wakeups: " << power.wakeups << " (" << static_cast<long>(power.wakeupsPerHour())
+                  << "/h at this interval), CPU per transmission: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(power.cpuPerTransmission()).count()
+                  << " us" << std::endl;
+
+        [[maybe_unused]] const long slack = prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0);
+        try
+        {
+            beacon.run(1, [](MorseSequencer::Line, bool)
+                       { throw std::runtime_error("keyer fault"); });
+            assert(false);
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        assert(prctl(PR_GET_TIMERSLACK, 0, 0, 0, 0) == slack);
+
+        std::cout << "[Test Passed] Beacon test successful." << std::endl;
+#endif
+
         std::cout << "[Test] Invalid character test (expected to throw):" << std::endl;
         morse_message.setMessage(std::string("HELLO @ WORLD"));  // Valid input
         std::cout << morse_message.getMessage() << std::endl;
@@ -0,0 +1,52 @@
+#!/usr/bin/env bash
+# -----------------------------------------------------------------------------
+# MIT License
+#
+# Copyright (c) 2025 Lee C. Bussy (@lbussy)
+#
+# See LICENSE.md for the full license text.
+# -----------------------------------------------------------------------------
+
+# Attach bpftrace to the "morse" USDT probes in a running process or a
+# freshly launched binary and print one line per event.
+#
+# Usage:
+#   sudo ./tools/morse_trace.sh <binary> [pid]
+#
+# The binary must have been built with <sys/sdt.h> available; check with:
+#   readelf -n <binary> | grep -A2 stapsdt
+
+set -euo pipefail
+
+if [[ $# -lt 1 ]]; then
+    echo "Usage: $0 <binary> [pid]" >&2
+    exit 1
+fi
+
+BIN=$(readlink -f "$1")
+PID=${2:-}
+
+read -r -d '' PROG <<BT || true
+usdt:${BIN}:morse:message_set
+{
+    printf("%-8d message_set     len=%-4d words=%-3d \"%s\"\n",
+           pid, arg1, arg2, str(arg0));
+}
+
+usdt:${BIN}:morse:word_encoded
+{
+    printf("%-8d word_encoded    idx=%-4d len=%-3d \"%s\"\n",
+           pid, arg0, arg2, str(arg1));
+}
+
+usdt:${BIN}:morse:message_encoded
+{
+    @encoded_len = hist(arg1);
+}
+BT
+
+if [[ -n "$PID" ]]; then
+    exec bpftrace -p "$PID" -e "$PROG"
+else
+    exec bpftrace -c "$BIN" -e "$PROG"
+fi